@@ -0,0 +1,52 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "aho_corasick_flat.h"
+
+int main() {
+    vector<string> dict = {"a", "ab", "bab", "bc", "bca", "c", "caa"};
+    AhoCorasick<> ac(dict);
+    assert(ac.link.size() == 11);
+    vector<pair<int, int>> found;
+    ac.find_all(string("abccab"), [&](int pos, int id) { found.push_back({pos, id}); });
+    sort(found.begin(), found.end());
+    assert(found == (vector<pair<int, int>>{{0, 0}, {0, 1}, {1, 3}, {2, 5}, {3, 5}, {4, 0}, {4, 1}}));
+    assert(ac.count(string("abccab")) == 7);
+
+    mt19937 rng(44);
+    for (int iter = 0; iter < 500; iter++) {
+        int k = rng() % 3 + 1, cnt = rng() % 10 + 1;
+        bool bytes = iter % 5 == 0;
+        auto random_char = [&]() { return bytes ? (char)(rng() % 256) : (char)('a' + rng() % k); };
+        vector<string> patterns(cnt);
+        for (auto& p : patterns) {
+            p.resize(rng() % 5 + 1);
+            for (char& c : p)
+                c = random_char();
+        }
+        if (iter % 3 == 0)
+            patterns.push_back(patterns[0]);
+        string text(rng() % 100, 'a');
+        for (char& c : text)
+            c = random_char();
+
+        set<pair<int, int>> expected;
+        for (int id = 0; id < (int)patterns.size(); id++)
+            for (size_t i = 0; i + patterns[id].size() <= text.size(); i++)
+                if (text.compare(i, patterns[id].size(), patterns[id]) == 0)
+                    expected.insert({(int)i, id});
+
+        AhoCorasick<> automaton(patterns);
+        multiset<pair<int, int>> got;
+        automaton.find_all(text, [&](int pos, int id) { got.insert({pos, id}); });
+        assert(got.size() == expected.size());
+        assert((set<pair<int, int>>(got.begin(), got.end()) == expected));
+        assert(automaton.count(text) == (long long)expected.size());
+    }
+
+    // 16-bit characters
+    vector<vector<uint16_t>> patterns = {{1000, 2000}, {2000}, {65535, 1000}};
+    AhoCorasick<uint16_t> wide(patterns);
+    assert(wide.count(vector<uint16_t>{65535, 1000, 2000, 7}) == 3);
+}
@@ -0,0 +1,61 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "aho_corasick_flat.h"
+#include "aho_corasick_stream.h"
+
+using Match = pair<long long, int>;
+
+int main() {
+    mt19937 rng(45);
+    for (int iter = 0; iter < 300; iter++) {
+        int k = rng() % 3 + 1, cnt = rng() % 8 + 1;
+        vector<string> patterns(cnt);
+        for (auto& p : patterns) {
+            p.resize(rng() % 6 + 1);
+            for (char& c : p)
+                c = 'a' + rng() % k;
+        }
+        string text(rng() % 500, 'a');
+        for (char& c : text)
+            c = 'a' + rng() % k;
+
+        AhoCorasick<> ac(patterns);
+        vector<Match> expected;
+        ac.find_all(text, [&](int pos, int id) { expected.push_back({pos, id}); });
+        sort(expected.begin(), expected.end());
+
+        // random chunks, small batches
+        StreamScanner<> scanner(ac, 1 + rng() % 5);
+        vector<Match> got;
+        auto collect = [&](vector<Match> const& batch) {
+            assert(!batch.empty());
+            got.insert(got.end(), batch.begin(), batch.end());
+        };
+        auto data = reinterpret_cast<unsigned char const*>(text.data());
+        for (size_t pos = 0; pos < text.size();) {
+            size_t len = min<size_t>(rng() % 10, text.size() - pos);
+            scanner.feed(data + pos, len, collect);
+            pos += len;
+        }
+        scanner.flush(collect);
+        sort(got.begin(), got.end());
+        assert(got == expected);
+
+        got.clear();
+        stringstream in(text);
+        scan_stream(ac, in, collect, 1 + rng() % 7);
+        sort(got.begin(), got.end());
+        assert(got == expected);
+
+        got.clear();
+        mutex m;
+        parallel_find_all(ac, data, (long long)text.size(), iter % 5, [&](vector<Match> const& batch) {
+            lock_guard<mutex> lock(m);
+            collect(batch);
+        });
+        sort(got.begin(), got.end());
+        assert(got == expected);
+    }
+}
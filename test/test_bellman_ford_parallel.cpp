@@ -0,0 +1,87 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "parallel_for.h"
+#include "bellman_ford_parallel.h"
+#include "data/sssp.h"
+
+int main() {
+    for (auto const& graph : sssp_graphs) {
+        vector<long long> d;
+        vector<int> p, cycle;
+        assert(parallel_bellman_ford(graph.adj, graph.s, d, p, cycle, 2));
+        for (int v = 0; v < (int)d.size(); v++)
+            assert(d[v] == (graph.expected_d[v] == 1000000000 ? INF : graph.expected_d[v]));
+    }
+
+    mt19937 rng(29);
+    for (int iter = 0; iter < 500; iter++) {
+        int n = rng() % 15 + 1, m = rng() % 40, s = rng() % n, threads = 1 + iter % 4;
+        vector<vector<pair<int, int>>> adj(n);
+        vector<array<int, 3>> edges;
+        for (int i = 0; i < m; i++) {
+            int a = rng() % n, b = rng() % n, w = (int)(rng() % 30) - (iter % 3 == 0 ? 3 : 10);
+            adj[a].push_back({b, w});
+            edges.push_back({a, b, w});
+        }
+
+        vector<long long> naive(n, INF);
+        naive[s] = 0;
+        bool has_cycle = false;
+        for (int it = 0; it <= n; it++) {
+            bool changed = false;
+            for (auto [a, b, w] : edges) {
+                if (naive[a] < INF && naive[a] + w < naive[b]) {
+                    naive[b] = naive[a] + w;
+                    changed = true;
+                }
+            }
+            if (it == n && changed)
+                has_cycle = true;
+        }
+
+        vector<long long> d;
+        vector<int> p, cycle;
+        bool ok = parallel_bellman_ford(adj, s, d, p, cycle, threads);
+        assert(ok == !has_cycle);
+        if (ok) {
+            assert(d == naive);
+            for (int v = 0; v < n; v++) {
+                if (v == s || d[v] == INF) {
+                    assert(p[v] == -1);
+                    continue;
+                }
+                bool found = false;
+                for (auto [to, w] : adj[p[v]])
+                    found |= to == v && d[p[v]] + w == d[v];
+                assert(found);
+            }
+        } else {
+            assert(!cycle.empty());
+            long long weight = 0;
+            for (int i = 0; i < (int)cycle.size(); i++) {
+                int a = cycle[i], b = cycle[(i + 1) % cycle.size()];
+                long long best = INF;
+                for (auto [to, w] : adj[a])
+                    if (to == b)
+                        best = min(best, (long long)w);
+                assert(best < INF);
+                weight += best;
+            }
+            assert(weight < 0);
+            assert(naive[cycle[0]] < INF);
+        }
+    }
+
+    int n = 2000;
+    vector<vector<pair<int, int>>> adj(n);
+    for (int i = 0; i + 1 < n; i++)
+        adj[i].push_back({i + 1, -1});
+    adj[n - 1].push_back({n / 2, n / 2 - 2});
+    vector<long long> d;
+    vector<int> p, cycle;
+    assert(!parallel_bellman_ford(adj, 0, d, p, cycle, 3));
+    assert((int)cycle.size() == n - n / 2);
+    return 0;
+}
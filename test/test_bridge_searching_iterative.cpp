@@ -0,0 +1,85 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "bridge_searching_iterative.h"
+
+int count_components(int n, vector<pair<int, int>> const& edges, int skip_vertex = -1, int skip_edge = -1) {
+    vector<int> p(n);
+    iota(p.begin(), p.end(), 0);
+    function<int(int)> find = [&](int v) { return p[v] == v ? v : p[v] = find(p[v]); };
+    int comps = n - (skip_vertex != -1);
+    for (int e = 0; e < (int)edges.size(); e++) {
+        auto [u, v] = edges[e];
+        if (e == skip_edge || u == skip_vertex || v == skip_vertex)
+            continue;
+        if (find(u) != find(v)) {
+            p[find(u)] = find(v);
+            comps--;
+        }
+    }
+    return comps;
+}
+
+int main() {
+    mt19937 rng(3);
+    for (int iter = 0; iter < 500; iter++) {
+        int n = rng() % 12 + 1, m = rng() % 20;
+        vector<pair<int, int>> edges;
+        for (int i = 0; i < m; i++)
+            edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+        Biconnectivity bc(n, edges);
+        int base = count_components(n, edges);
+
+        for (int e = 0; e < m; e++)
+            assert(bc.is_bridge[e] == (count_components(n, edges, -1, e) > base));
+
+        for (int v = 0; v < n; v++) {
+            bool isolated = true;
+            for (auto [a, b] : edges)
+                if ((a == v) != (b == v))
+                    isolated = false;
+            int expected = count_components(n, edges, v) + isolated;
+            assert(bc.is_cut[v] == (expected > base));
+        }
+
+        vector<pair<int, int>> no_bridges;
+        for (int e = 0; e < m; e++)
+            if (!bc.is_bridge[e])
+                no_bridges.push_back(edges[e]);
+        vector<int> p(n);
+        iota(p.begin(), p.end(), 0);
+        function<int(int)> find = [&](int v) { return p[v] == v ? v : p[v] = find(p[v]); };
+        for (auto [a, b] : no_bridges)
+            p[find(a)] = find(b);
+        for (int u = 0; u < n; u++)
+            for (int v = 0; v < n; v++)
+                assert((bc.comp2e[u] == bc.comp2e[v]) == (find(u) == find(v)));
+
+        for (int v = 0; v < n; v++) {
+            set<int> comps;
+            for (int e = 0; e < m; e++)
+                if ((edges[e].first == v) != (edges[e].second == v))
+                    comps.insert(bc.bcc[e]);
+            assert(bc.is_cut[v] == (comps.size() > 1));
+        }
+        for (int e = 0; e < m; e++) {
+            assert((bc.bcc[e] == -1) == (edges[e].first == edges[e].second));
+            if (bc.is_bridge[e])
+                for (int f = 0; f < m; f++)
+                    assert(f == e || bc.bcc[f] != bc.bcc[e]);
+        }
+    }
+
+    {
+        int n = 1000000;
+        vector<pair<int, int>> edges;
+        for (int i = 0; i + 1 < n; i++)
+            edges.push_back({i, i + 1});
+        edges.push_back({n - 1, n - 3});
+        Biconnectivity bc(n, edges);
+        assert(bc.cnt2e == n - 2 && bc.cnt_bcc == n - 2);
+        assert(bc.is_bridge[0] && !bc.is_bridge[n - 2] && bc.is_cut[n - 3] && !bc.is_cut[n - 2]);
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "centroid_tree.h"
+
+int main() {
+    mt19937 rng(9);
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 50 + 1;
+        vector<vector<int>> adj(n);
+        for (int i = 1; i < n; i++) {
+            int p = iter % 4 == 0 ? i - 1 : rng() % i;
+            if (iter % 4 == 3 && rng() % 4 == 0)
+                continue;  // a forest
+            adj[p].push_back(i);
+            adj[i].push_back(p);
+        }
+        vector<vector<int>> d(n, vector<int>(n, -1));
+        for (int s = 0; s < n; s++) {
+            queue<int> q;
+            q.push(s);
+            d[s][s] = 0;
+            while (!q.empty()) {
+                int v = q.front();
+                q.pop();
+                for (int u : adj[v])
+                    if (d[s][u] == -1) {
+                        d[s][u] = d[s][v] + 1;
+                        q.push(u);
+                    }
+            }
+        }
+
+        CentroidTree ct(adj);
+        for (int v = 0; v < n; v++)
+            assert(ct.level[v] < ct.H && (ct.parent[v] == -1) == (ct.level[v] == 0));
+
+        for (int K = 0; K <= n; K++) {
+            long long expected = 0;
+            for (int u = 0; u < n; u++)
+                for (int v = u + 1; v < n; v++)
+                    expected += d[u][v] == K;
+            assert(ct.count_paths(K) == expected);
+        }
+        for (int v = 0; v < n; v++) {
+            for (int k = -1; k <= n; k++) {
+                long long expected = 0;
+                for (int u = 0; u < n; u++)
+                    expected += d[v][u] != -1 && d[v][u] <= k;
+                assert(ct.count_within(v, k) == expected);
+            }
+        }
+
+        vector<int> marked;
+        for (int op = 0; op < 50; op++) {
+            int v = rng() % n;
+            if (rng() % 2) {
+                ct.mark(v);
+                marked.push_back(v);
+            } else {
+                int expected = INT_MAX;
+                for (int u : marked)
+                    if (d[v][u] != -1)
+                        expected = min(expected, d[v][u]);
+                assert(ct.nearest_marked(v) == expected);
+            }
+        }
+    }
+
+    int n = 200000;
+    vector<vector<int>> adj(n);
+    for (int i = 0; i + 1 < n; i++) {
+        adj[i].push_back(i + 1);
+        adj[i + 1].push_back(i);
+    }
+    CentroidTree ct(adj);
+    assert(ct.count_paths(1) == n - 1 && ct.count_paths(n - 1) == 1);
+    ct.mark(0);
+    assert(ct.nearest_marked(n - 1) == n - 1);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+namespace DENSE {
+#include "dijkstra_dense.h"
+}
+#include "dijkstra_matrix.h"
+#include "data/sssp.h"
+
+int main() {
+    for (auto const& graph : sssp_graphs) {
+        int n = graph.adj.size();
+        vector<int> w(n * n, DENSE::INF);
+        for (int v = 0; v < n; v++)
+            for (auto [to, len] : graph.adj[v])
+                w[v * n + to] = min(w[v * n + to], len);
+        vector<int> d, p;
+        dijkstra_matrix(n, w, graph.s, d, p);
+        assert(d == graph.expected_d);
+    }
+
+    mt19937 rng(17);
+    for (int iter = 0; iter < 100; iter++) {
+        int n = rng() % 60 + 1, s = rng() % n;
+        vector<int> w(n * n);
+        DENSE::adj.assign(n, {});
+        for (int v = 0; v < n; v++) {
+            for (int to = 0; to < n; to++) {
+                w[v * n + to] = rng() % 4 ? rng() % 1000 : DENSE::INF;
+                if (w[v * n + to] != DENSE::INF)
+                    DENSE::adj[v].push_back({to, w[v * n + to]});
+            }
+        }
+        vector<int> d1, p1, d2, p2;
+        DENSE::dijkstra(s, d1, p1);
+        dijkstra_matrix(n, w, s, d2, p2);
+        assert(d1 == d2);
+        for (int v = 0; v < n; v++) {
+            if (v != s && d2[v] != DENSE::INF)
+                assert(d2[p2[v]] + w[p2[v] * n + v] == d2[v]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "dynamic-connectivity-online.h"
+#include "dynamic-conn.h"
+
+int main() {
+    {
+        DynamicConnectivity dc(5);
+        dc.insert_edge(0, 1);
+        dc.insert_edge(1, 2);
+        dc.insert_edge(2, 0);
+        assert(dc.connected(0, 2) && !dc.connected(0, 3));
+        assert(dc.components() == 3);
+        dc.delete_edge(0, 1);
+        assert(dc.connected(0, 1));
+        dc.delete_edge(1, 2);
+        assert(!dc.connected(0, 1) && dc.connected(0, 2));
+        assert(dc.components() == 4);
+    }
+
+    mt19937 rng(1);
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 12 + 1, T = rng() % 200 + 1;
+        DynamicConnectivity dc(n);
+        QueryTree qt(T, n);
+        vector<pair<pair<int, int>, int>> alive;  // edge, insertion time
+        vector<int> comps(T);
+        for (int time = 0; time < T; time++) {
+            if (!alive.empty() && rng() % 5 < 2) {
+                int i = rng() % alive.size();
+                auto [e, start] = alive[i];
+                alive.erase(alive.begin() + i);
+                dc.delete_edge(e.second, e.first);
+                if (start < time)
+                    qt.add_query(query(e.first, e.second), start, time - 1);
+            } else {
+                int u = rng() % n, v = rng() % n;
+                alive.push_back({{u, v}, time});
+                dc.insert_edge(u, v);
+            }
+            comps[time] = dc.components();
+
+            vector<int> p(n);
+            iota(p.begin(), p.end(), 0);
+            function<int(int)> find = [&](int x) { return p[x] == x ? x : p[x] = find(p[x]); };
+            for (auto [e, start] : alive)
+                p[find(e.first)] = find(e.second);
+            for (int u = 0; u < n; u++)
+                for (int v = 0; v < n; v++)
+                    assert(dc.connected(u, v) == (find(u) == find(v)));
+        }
+        for (auto [e, start] : alive)
+            qt.add_query(query(e.first, e.second), start, T - 1);
+        assert(qt.solve() == comps);
+    }
+
+    {
+        int n = 2000;
+        DynamicConnectivity dc(n);
+        vector<pair<int, int>> alive;
+        for (int i = 0; i < 20000; i++) {
+            if (!alive.empty() && rng() % 2) {
+                int j = rng() % alive.size();
+                swap(alive[j], alive.back());
+                dc.delete_edge(alive.back().first, alive.back().second);
+                alive.pop_back();
+            } else {
+                int u = rng() % n, v = rng() % n;
+                dc.insert_edge(u, v);
+                alive.push_back({u, v});
+            }
+        }
+        vector<int> p(n);
+        iota(p.begin(), p.end(), 0);
+        function<int(int)> find = [&](int x) { return p[x] == x ? x : p[x] = find(p[x]); };
+        int comps = n;
+        for (auto [u, v] : alive)
+            if (find(u) != find(v)) {
+                p[find(u)] = find(v);
+                comps--;
+            }
+        assert(dc.components() == comps);
+        for (int i = 0; i < 1000; i++) {
+            int u = rng() % n, v = rng() % n;
+            assert(dc.connected(u, v) == (find(u) == find(v)));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "suffix_automaton_transitions.h"
+#include "eertree.h"
+#include "manacher_block.h"
+
+template <typename Tree>
+void check(Tree const& t, string const& s) {
+    int n = s.size();
+    map<string, long long> expected;
+    for (int l = 0; l < n; l++) {
+        for (int r = l + 1; r <= n; r++) {
+            string sub = s.substr(l, r - l);
+            if (equal(sub.begin(), sub.end(), sub.rbegin()))
+                expected[sub]++;
+        }
+    }
+    assert(t.distinct == (int)expected.size());
+
+    auto [d_odd, d_even] = manacher_both(s);
+    long long total = accumulate(d_odd.begin(), d_odd.end(), 0LL) + accumulate(d_even.begin(), d_even.end(), 0LL);
+    assert(t.total == total);
+
+    // reconstruct the palindrome of every node from the transitions
+    vector<string> str(t.size());
+    vector<int> order = {0, 1};
+    for (size_t k = 0; k < order.size(); k++) {
+        int v = order[k];
+        t.next.for_each(v, [&](int c, int to) {
+            char ch = 'a' + c;
+            str[to] = t.len[v] == -1 ? string(1, ch) : ch + str[v] + ch;
+            order.push_back(to);
+        });
+    }
+    assert((int)order.size() == t.size());
+
+    vector<long long> occ = t.occurrences();
+    int present = 0;
+    for (int v = 2; v < t.size(); v++) {
+        assert((int)str[v].size() == t.len[v]);
+        auto it = expected.find(str[v]);
+        long long cnt = it == expected.end() ? 0 : it->second;
+        assert(occ[v] == cnt);
+        present += cnt > 0;
+        if (t.len[v] > 1)
+            assert(str[t.link[v]] == str[v].substr(str[v].size() - t.len[t.link[v]]));
+    }
+    assert(present == t.distinct);
+}
+
+template <typename Transitions>
+void test_random(mt19937& rng) {
+    for (int it = 0; it < 300; it++) {
+        int k = rng() % 3 + 1;
+        Eertree<Transitions> t;
+        string s;
+        for (int step = 0; step < 60; step++) {
+            if (!s.empty() && rng() % 3 == 0) {
+                t.pop_back();
+                s.pop_back();
+            } else {
+                int c = rng() % k;
+                t.push_back(c);
+                s += 'a' + c;
+            }
+            check(t, s);
+        }
+    }
+}
+
+int main() {
+    Eertree<DenseTransitions<26>> t;
+    for (char c : string("eertree"))
+        t.push_back(c - 'a');
+    assert(t.distinct == 7);  // e, r, t, ee, rtr, ertre, eertree
+    assert(t.size() == 9);
+    check(t, "eertree");
+    t.pop_back();
+    assert(t.distinct == 6);
+
+    mt19937 rng(19);
+    test_random<DenseTransitions<26>>(rng);
+    test_random<SmallVectorTransitions<2>>(rng);
+    test_random<HashTransitions>(rng);
+
+    // alternating push and pop of a character that ends a long walk
+    Eertree<DenseTransitions<26>> u;
+    int n = 100000;
+    for (int i = 0; i < n; i++)
+        u.push_back(0);
+    for (int it = 0; it < n; it++) {
+        u.push_back(1);
+        u.pop_back();
+    }
+    assert(u.distinct == n && u.total == (long long)n * (n + 1) / 2);
+}
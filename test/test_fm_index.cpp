@@ -0,0 +1,67 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "suffix_array_sais.h"
+#include "suffix_array_sais_wrappers.h"
+#include "fm_index.h"
+#include "fm_index_io.h"
+
+int main() {
+    FMIndex banana("banana");
+    string bwt;
+    for (int i = 0; i < banana.N; i++) {
+        int c = banana.access(i);
+        bwt += c == 0 ? '$' : "abn"[c - 1];
+    }
+    assert(bwt == "annb$aa");
+    assert(banana.count("ana") == 2);
+    assert(banana.locate("ana") == (vector<int>{1, 3}));
+    assert(banana.count("") == 6);
+    assert(banana.count("x") == 0);
+    assert(banana.count("nab") == 0);
+
+    mt19937 rng(41);
+    for (int iter = 0; iter < 500; iter++) {
+        int n = rng() % 100, k = rng() % 5 + 1, step = rng() % 8 + 1;
+        string t(n, 'a');
+        for (char& c : t)
+            c = iter % 7 == 0 ? (char)(rng() % 256) : 'a' + rng() % k;
+
+        FMIndex built(t, step);
+        stringstream file;
+        write_index(file, built);
+        FMIndex index = read_index(file);
+
+        for (int q = 0; q < 40; q++) {
+            string s;
+            if (n > 0 && q % 2 == 0) {
+                int i = rng() % n;
+                s = t.substr(i, 1 + rng() % (n - i));
+            } else {
+                s.resize(1 + rng() % 4);
+                for (char& c : s)
+                    c = 'a' + rng() % (k + 1);
+            }
+            vector<int> expected;
+            for (int i = 0; i + (int)s.size() <= n; i++)
+                if (t.compare(i, s.size(), s) == 0)
+                    expected.push_back(i);
+            assert(index.count(s) == (int)expected.size());
+            assert(index.locate(s) == expected);
+        }
+    }
+
+    // memory on a DNA-like text stays below one byte per character
+    int n = 1 << 20;
+    string t(n, 'A');
+    for (char& c : t)
+        c = "ACGT"[rng() % 4];
+    FMIndex index(t);
+    stringstream file;
+    write_index(file, index);
+    assert(file.str().size() < (size_t)n);
+    string s = t.substr(12345, 20);
+    vector<int> pos = index.locate(s);
+    assert(find(pos.begin(), pos.end(), 12345) != pos.end());
+}
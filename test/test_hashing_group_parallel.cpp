@@ -0,0 +1,52 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "parallel_for.h"
+#include "hashing_mod61.h"
+#include "hashing_group_parallel.h"
+
+void check(vector<string> const& s, int threads) {
+    StringGroups res = group_identical_strings_parallel(s, threads);
+    map<string, vector<int>> expected;
+    for (int i = 0; i < (int)s.size(); i++)
+        expected[s[i]].push_back(i);
+
+    assert(res.size() == (int)expected.size());
+    assert((int)res.index.size() == (int)s.size());
+    assert(res.start[0] == 0 && res.start.back() == (int)s.size());
+    for (int g = 0; g < res.size(); g++) {
+        vector<int> group(res.index.begin() + res.start[g], res.index.begin() + res.start[g + 1]);
+        assert(!group.empty());
+        assert(expected[s[group[0]]] == group);
+    }
+}
+
+int main() {
+    check({}, 1);
+    check({"a", "b", "abc", "b", "b", "abc"}, 1);
+    check({"a", "b", "abc", "b", "b", "abc"}, 3);
+    check({"a", "b", "abc", "b", "b", "abc"}, 0);
+
+    mt19937 rng(5);
+    for (int n : {10, 1000, 100000}) {
+        vector<string> s(n);
+        for (auto& x : s) {
+            x.resize(rng() % 4);
+            for (char& c : x)
+                c = 'a' + rng() % 3;
+        }
+        for (int threads : {1, 2, 4})
+            check(s, threads);
+    }
+
+    // with p = 1 the hash is the sum of the characters, so all anagrams collide
+    StringHash::p = 1;
+    vector<string> s(20000);
+    for (auto& x : s) {
+        x.resize(rng() % 6);
+        for (char& c : x)
+            c = 'a' + rng() % 4;
+    }
+    for (int threads : {1, 4})
+        check(s, threads);
+}
@@ -0,0 +1,74 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "hashing_mod61.h"
+#include "hashing_mod61_applications.h"
+#include "rabin_karp_mod61.h"
+
+uint64_t naive_hash(string const& s) {
+    __uint128_t h = 0;
+    for (unsigned char c : s)
+        h = (h * StringHash::p + c + 1) % MOD61;
+    return h;
+}
+
+int main() {
+    mt19937 rng(7);
+    for (int it = 0; it < 1000; it++) {
+        uint64_t a = rng() * (uint64_t)rng() % MOD61, b = rng() * (uint64_t)rng() % MOD61;
+        if (it == 0)
+            a = b = MOD61 - 1;
+        assert(mul_mod61(a, b) == (uint64_t)((__uint128_t)a * b % MOD61));
+    }
+
+    assert(compute_hash("abc") != compute_hash("abd"));
+    vector<string> v = {"a", "b", "abc", "b", "b", "abc"};
+    auto groups = group_identical_strings(v);
+    assert(groups.size() == 3);
+    assert(count_unique_substrings("abaabcabc") == 35);
+
+    string t = "aabbabbbcddbadabbaac";
+    assert(rabin_karp("abb", t) == vector<int>({1, 4, 14}));
+
+    for (int it = 0; it < 200; it++) {
+        int n = rng() % 40 + 1;
+        int k = rng() % 3 + 1;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        if (it % 10 == 0)
+            s[rng() % n] = '\0';
+
+        StringHash hs(s);
+        assert(hs.size() == n);
+        assert(hs.get(0, n) == naive_hash(s));
+        assert(StringHash::of(s) == naive_hash(s));
+        for (int l = 0; l <= n; l++)
+            for (int r = l; r <= n; r++)
+                assert(hs.get(l, r) == naive_hash(s.substr(l, r - l)));
+
+        string u(rng() % 10 + 1, 'a');
+        for (char& c : u)
+            c = 'a' + rng() % k;
+        StringHash hu(u);
+        for (int i = 0; i <= n; i++) {
+            for (int j = 0; j <= (int)u.size(); j++) {
+                int expected = 0;
+                while (i + expected < n && j + expected < (int)u.size() && s[i + expected] == u[j + expected])
+                    expected++;
+                assert(lce(hs, i, hu, j) == expected);
+            }
+        }
+
+        set<string> distinct;
+        for (int l = 0; l < n; l++)
+            for (int r = l + 1; r <= n; r++)
+                distinct.insert(s.substr(l, r - l));
+        assert(count_unique_substrings(s) == (long long)distinct.size());
+
+        vector<int> occ;
+        for (size_t pos = s.find(u); pos != string::npos; pos = s.find(u, pos + 1))
+            occ.push_back(pos);
+        assert(rabin_karp(u, s) == occ);
+    }
+}
@@ -0,0 +1,87 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "lazy_segment_tree.h"
+#include "lazy_segment_tree_sum_add_assign.h"
+#include "hld_lazy.h"
+
+int main() {
+    mt19937 rng(5);
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 60 + 1, root = rng() % n;
+        vector<vector<int>> adj(n);
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        shuffle(order.begin(), order.end(), rng);
+        for (int i = 1; i < n; i++) {
+            int p = order[iter % 3 == 0 ? i - 1 : rng() % i];
+            adj[p].push_back(order[i]);
+            adj[order[i]].push_back(p);
+        }
+        vector<long long> val(n);
+        vector<SumAddAssign::S> init(n);
+        for (int v = 0; v < n; v++) {
+            val[v] = rng() % 100;
+            init[v] = {val[v], 1};
+        }
+        HLD<SumAddAssign> hld(adj, init, root);
+
+        vector<int> par(n, -1), dep(n, 0), bfs = {root};
+        for (int i = 0; i < (int)bfs.size(); i++)
+            for (int c : adj[bfs[i]])
+                if (c != par[bfs[i]]) {
+                    par[c] = bfs[i];
+                    dep[c] = dep[bfs[i]] + 1;
+                    bfs.push_back(c);
+                }
+        auto path = [&](int a, int b) {
+            vector<int> res;
+            while (a != b) {
+                if (dep[a] < dep[b])
+                    swap(a, b);
+                res.push_back(a);
+                a = par[a];
+            }
+            res.push_back(a);
+            return res;
+        };
+        auto subtree = [&](int v) {
+            vector<int> res;
+            for (int u = 0; u < n; u++) {
+                int w = u;
+                while (w != -1 && w != v)
+                    w = par[w];
+                if (w == v)
+                    res.push_back(u);
+            }
+            return res;
+        };
+
+        for (int op = 0; op < 200; op++) {
+            int a = rng() % n, b = rng() % n, type = rng() % 6;
+            long long x = rng() % 100;
+            SumAddAssign::F f = {type % 2 == 1, x, type % 2 ? 0 : x};
+            if (type < 2) {
+                hld.path_apply(a, b, f);
+                for (int v : path(a, b))
+                    val[v] = f.assign ? x : val[v] + x;
+            } else if (type < 4) {
+                hld.subtree_apply(a, f);
+                for (int v : subtree(a))
+                    val[v] = f.assign ? x : val[v] + x;
+            } else if (type == 4) {
+                long long expected = 0;
+                for (int v : path(a, b))
+                    expected += val[v];
+                assert(hld.path_query(a, b).sum == expected);
+            } else {
+                long long expected = 0;
+                for (int v : subtree(a))
+                    expected += val[v];
+                assert(hld.subtree_query(a).sum == expected);
+            }
+        }
+    }
+    return 0;
+}
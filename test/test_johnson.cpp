@@ -0,0 +1,67 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "johnson.h"
+
+int main() {
+    mt19937 rng(37);
+    for (int iter = 0; iter < 500; iter++) {
+        int n = rng() % 12 + 1, m = rng() % 40, threads = 1 + iter % 4;
+        vector<vector<pair<int, int>>> adj(n);
+        vector<vector<long long>> fw(n, vector<long long>(n, INF));
+        for (int v = 0; v < n; v++)
+            fw[v][v] = 0;
+        for (int i = 0; i < m; i++) {
+            int a = rng() % n, b = rng() % n, w = (int)(rng() % 30) - (iter % 3 == 0 ? 3 : 12);
+            adj[a].push_back({b, w});
+            fw[a][b] = min<long long>(fw[a][b], w);
+        }
+        for (int k = 0; k < n; k++)
+            for (int i = 0; i < n; i++)
+                for (int j = 0; j < n; j++)
+                    if (fw[i][k] < INF && fw[k][j] < INF)
+                        fw[i][j] = min(fw[i][j], fw[i][k] + fw[k][j]);
+        bool has_cycle = false;
+        for (int v = 0; v < n; v++)
+            has_cycle |= fw[v][v] < 0;
+
+        vector<vector<long long>> res(n);
+        vector<int> calls(n, 0);
+        bool ok = johnson(adj, [&](int s, vector<long long> const& d) {
+            res[s] = d;
+            calls[s]++;
+        }, threads);
+        assert(ok == !has_cycle);
+        if (ok) {
+            for (int s = 0; s < n; s++) {
+                assert(calls[s] == 1);
+                assert(res[s] == fw[s]);
+            }
+        }
+    }
+
+    // larger sparse graph: the sum over all rows must not depend on the number of threads
+    int n = 500;
+    vector<vector<pair<int, int>>> adj(n);
+    vector<long long> pot(n);
+    for (int v = 0; v < n; v++)
+        pot[v] = rng() % 1000;
+    for (int i = 0; i < 4 * n; i++) {
+        int a = rng() % n, b = rng() % n;
+        // weights reduced by potential differences: negative edges, but no negative cycles
+        adj[a].push_back({b, (int)(rng() % 100 + pot[b] - pot[a])});
+    }
+    vector<long long> sums;
+    for (int threads : {1, 4}) {
+        vector<long long> sum(n, 0);
+        assert(johnson(adj, [&](int s, vector<long long> const& d) {
+            for (long long x : d)
+                if (x != INF)
+                    sum[s] += x;
+        }, threads));
+        sums.push_back(accumulate(sum.begin(), sum.end(), 0LL));
+    }
+    assert(sums[0] == sums[1]);
+    return 0;
+}
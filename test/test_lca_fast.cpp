@@ -0,0 +1,44 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "lca.h"
+#include "lca_fast.h"
+
+int main() {
+    mt19937 rng(11);
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 300 + 1, root = rng() % n;
+        vector<vector<int>> adj(n);
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        shuffle(order.begin(), order.end(), rng);
+        for (int i = 1; i < n; i++) {
+            int p = order[iter % 2 ? i - 1 : rng() % i];
+            adj[p].push_back(order[i]);
+            adj[order[i]].push_back(p);
+        }
+        LCA expected(adj, root);
+        FastLCA<SparseTableRMQ> a(adj, root);
+        FastLCA<BlockRMQ> b(adj, root);
+        vector<pair<int, int>> queries;
+        for (int i = 0; i < 200; i++)
+            queries.push_back({(int)(rng() % n), (int)(rng() % n)});
+        vector<int> batch = b.lca(queries, 1 + iter % 3);
+        for (int i = 0; i < 200; i++) {
+            auto [u, v] = queries[i];
+            int w = expected.lca(u, v);
+            assert(a.lca(u, v) == w && b.lca(u, v) == w && batch[i] == w);
+        }
+    }
+
+    int n = 1000000;
+    vector<vector<int>> adj(n);
+    for (int i = 0; i + 1 < n; i++) {
+        adj[i].push_back(i + 1);
+        adj[i + 1].push_back(i);
+    }
+    FastLCA<> path(adj, 0);
+    assert(path.lca(n - 1, 5) == 5 && path.lca(123456, 654321) == 123456);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "manacher_odd.h"
+#include "manacher_block.h"
+
+bool is_palindrome(string const& s, int l, int r) {
+    for (; l < r; l++, r--)
+        if (s[l] != s[r])
+            return false;
+    return true;
+}
+
+int main() {
+    auto [d_odd, d_even] = manacher_both("abababc");
+    assert(d_odd[3] == 3);
+    tie(d_odd, d_even) = manacher_both("cbaabd");
+    assert(d_even[3] == 2);
+    tie(d_odd, d_even) = manacher_both("");
+    assert(d_odd.empty() && d_even.empty());
+
+    mt19937 rng(17);
+    for (int it = 0; it < 2000; it++) {
+        int n = rng() % 80;
+        int k = rng() % 3 + 1;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        if (it % 3 == 0) {
+            int p = rng() % 6 + 1;
+            for (int i = p; i < n; i++)
+                s[i] = rng() % 30 ? s[i - p] : 'z';
+        }
+
+        tie(d_odd, d_even) = manacher_both(s);
+        assert(d_odd == manacher_odd(s));
+        for (int i = 0; i < n; i++) {
+            int expected = 0;
+            while (i - expected - 1 >= 0 && i + expected < n && is_palindrome(s, i - expected - 1, i + expected))
+                expected++;
+            assert(d_even[i] == expected);
+        }
+    }
+}
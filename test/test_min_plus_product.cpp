@@ -0,0 +1,92 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "parallel_for.h"
+#include "min_plus_product.h"
+#include "min_plus_power.h"
+
+int main() {
+    mt19937 rng(23);
+    const long long MOD = 1000000007;
+    for (int iter = 0; iter < 60; iter++) {
+        int n = rng() % 20 + 1, k = rng() % 70, threads = 1 + iter % 3;
+        vector<long long> G((size_t)n * n), C((size_t)n * n);
+        for (auto& x : G)
+            x = rng() % 3 ? (long long)(rng() % 2001) - 1000 : INF;
+        for (auto& x : C)
+            x = rng() % 3;
+
+        vector<long long> naive((size_t)n * n, INF), cnt((size_t)n * n, 0);
+        for (int i = 0; i < n; i++)
+            naive[i * n + i] = 0, cnt[i * n + i] = 1;
+        for (int step = 0; step < k; step++) {
+            vector<long long> next((size_t)n * n, INF), next_cnt((size_t)n * n, 0);
+            for (int i = 0; i < n; i++)
+                for (int p = 0; p < n; p++)
+                    for (int j = 0; j < n; j++) {
+                        if (naive[i * n + p] != INF && G[p * n + j] != INF)
+                            next[i * n + j] = min(next[i * n + j], naive[i * n + p] + G[p * n + j]);
+                        next_cnt[i * n + j] = (next_cnt[i * n + j] + cnt[i * n + p] * C[p * n + j]) % MOD;
+                    }
+            naive = next;
+            cnt = next_cnt;
+        }
+        assert(shortest_paths(n, G, k, false, threads) == naive);
+        assert(count_paths(n, C, k, MOD, threads) == cnt);
+        vector<long long> C_unreduced = C;
+        for (auto& x : C_unreduced)
+            x += ((long long)(rng() % 2001) - 1000) * MOD;
+        assert(count_paths(n, C_unreduced, k, MOD, threads) == cnt);
+
+        vector<long long> H = G;
+        for (auto& x : H)
+            if (x != INF)
+                x = abs(x);
+        for (int i = 0; i < n; i++)
+            H[i * n + i] = 0;
+        vector<long long> at_most = H;
+        for (int step = 1; step < max(k, 1); step++) {
+            vector<long long> next = at_most;
+            for (int i = 0; i < n; i++)
+                for (int p = 0; p < n; p++)
+                    for (int j = 0; j < n; j++)
+                        if (at_most[i * n + p] != INF && H[p * n + j] != INF)
+                            next[i * n + j] = min(next[i * n + j], at_most[i * n + p] + H[p * n + j]);
+            at_most = next;
+        }
+        if (k > 0)
+            assert(shortest_paths(n, H, k, true, threads) == at_most);
+    }
+
+    int n = 150;
+    vector<long long> G((size_t)n * n);
+    for (auto& x : G)
+        x = rng() % 1000;
+    for (int i = 0; i < n; i++)
+        G[i * n + i] = 0;
+    vector<long long> D = shortest_paths(n, G, 64, true, 2);
+    vector<long long> F = G;
+    for (int p = 0; p < n; p++)
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++)
+                F[i * n + j] = min(F[i * n + j], F[i * n + p] + F[p * n + j]);
+    assert(D == F);
+
+    // several tiles in both directions, compared on random entries
+    n = 600;
+    vector<long long> A((size_t)n * n), B((size_t)n * n), P;
+    for (auto& x : A)
+        x = rng() % MOD;
+    for (auto& x : B)
+        x = rng() % MOD;
+    count_multiply(n, A, B, P, MOD, 3);
+    for (int iter = 0; iter < 300; iter++) {
+        int i = rng() % n, j = iter < 2 ? n - 1 : rng() % n;
+        long long expected = 0;
+        for (int p = 0; p < n; p++)
+            expected = (expected + A[i * n + p] * B[p * n + j]) % MOD;
+        assert(P[i * n + j] == expected);
+    }
+    return 0;
+}
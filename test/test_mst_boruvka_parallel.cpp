@@ -0,0 +1,75 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "dsu-concurrent.h"
+#include "parallel_for.h"
+#include "mst-boruvka-parallel.h"
+
+long long kruskal(int n, vector<Edge> edges) {
+    vector<int> p(n);
+    iota(p.begin(), p.end(), 0);
+    function<int(int)> find = [&](int v) { return p[v] == v ? v : p[v] = find(p[v]); };
+    sort(edges.begin(), edges.end(), [](Edge a, Edge b) { return a.weight < b.weight; });
+    long long cost = 0;
+    for (Edge e : edges) {
+        if (find(e.u) != find(e.v)) {
+            p[find(e.u)] = find(e.v);
+            cost += e.weight;
+        }
+    }
+    return cost;
+}
+
+int count_components(int n, vector<Edge> const& edges) {
+    vector<int> p(n);
+    iota(p.begin(), p.end(), 0);
+    function<int(int)> find = [&](int v) { return p[v] == v ? v : p[v] = find(p[v]); };
+    int comps = n;
+    for (Edge e : edges) {
+        if (find(e.u) != find(e.v)) {
+            p[find(e.u)] = find(e.v);
+            comps--;
+        }
+    }
+    return comps;
+}
+
+int main() {
+    mt19937 rng(7);
+
+    {
+        int n = 100000, threads = 4;
+        ConcurrentDSU dsu(n);
+        vector<pair<int, int>> ops(200000);
+        for (auto& [a, b] : ops) {
+            a = rng() % n;
+            b = rng() % n;
+        }
+        atomic<int> unions{0};
+        parallel_for(ops.size(), threads, [&](int, int l, int r) {
+            for (int i = l; i < r; i++)
+                unions += dsu.union_sets(ops[i].first, ops[i].second);
+        });
+        vector<Edge> edges;
+        for (auto [a, b] : ops)
+            edges.push_back({a, b, 0});
+        assert(n - unions == count_components(n, edges));
+        for (auto [a, b] : ops)
+            assert(dsu.same_set(a, b));
+    }
+
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 30 + 1, m = rng() % 100;
+        int maxw = iter % 2 ? 5 : 1000000000;
+        vector<Edge> edges;
+        for (int i = 0; i < m; i++)
+            edges.push_back({(int)(rng() % n), (int)(rng() % n), (int)(rng() % (2 * maxw + 1)) - maxw});
+        vector<Edge> result;
+        long long cost = boruvka_mst(n, edges, result, 1 + iter % 4);
+        assert(cost == kruskal(n, edges));
+        assert((int)result.size() == n - count_components(n, edges));
+        assert(count_components(n, result) == count_components(n, edges));
+    }
+    return 0;
+}
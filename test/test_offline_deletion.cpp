@@ -0,0 +1,115 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "offline-deletion.h"
+#include "offline-deletion-dsu.h"
+#include "offline-deletion-xor-basis.h"
+
+int brute_components(int n, const vector<pair<int, int>>& edges) {
+    vector<vector<int>> adj(n);
+    for (auto [a, b] : edges) {
+        adj[a].push_back(b);
+        adj[b].push_back(a);
+    }
+    vector<bool> used(n);
+    int comps = 0;
+    for (int s = 0; s < n; s++) {
+        if (used[s])
+            continue;
+        comps++;
+        vector<int> st = {s};
+        used[s] = true;
+        while (!st.empty()) {
+            int v = st.back();
+            st.pop_back();
+            for (int u : adj[v]) {
+                if (!used[u]) {
+                    used[u] = true;
+                    st.push_back(u);
+                }
+            }
+        }
+    }
+    return comps;
+}
+
+unsigned int brute_max_xor(const vector<unsigned int>& a) {
+    set<unsigned int> reach = {0};
+    for (unsigned int x : a) {
+        set<unsigned int> nxt = reach;
+        for (unsigned int y : reach)
+            nxt.insert(x ^ y);
+        reach = nxt;
+    }
+    return *reach.rbegin();
+}
+
+int main() {
+    {
+        OfflineDeletion<rollback_dsu> od(11);
+        od.add_update({0, 1}, 1, 10);
+        od.add_update({1, 2}, 2, 7);
+        od.add_update({2, 3}, 3, 10);
+        od.add_update({3, 4}, 4, 9);
+        od.add_update({4, 0}, 5, 10);
+        rollback_dsu dsu(5);
+        vector<int> ans(11);
+        od.solve(dsu, [&](int t, rollback_dsu& d) { ans[t] = d.comps; });
+        assert(ans[0] == 5);
+        assert(ans[6] == 1);
+        assert(ans[8] == 1);
+        assert(ans[10] == 2);
+        assert(dsu.comps == 5);
+    }
+
+    mt19937 rng(42);
+    for (int iter = 0; iter < 100; iter++) {
+        int n = rng() % 8 + 1, T = rng() % 30 + 1, m = rng() % 20;
+        vector<tuple<int, int, int, int>> edges;
+        OfflineDeletion<rollback_dsu> od(T);
+        for (int i = 0; i < m; i++) {
+            int a = rng() % n, b = rng() % n, l = rng() % T, r = rng() % T;
+            if (l > r)
+                swap(l, r);
+            edges.emplace_back(a, b, l, r);
+            od.add_update({a, b}, l, r);
+        }
+        rollback_dsu dsu(n);
+        vector<int> visited;
+        od.solve(dsu, [&](int t, rollback_dsu& d) {
+            visited.push_back(t);
+            vector<pair<int, int>> alive;
+            for (auto [a, b, l, r] : edges)
+                if (l <= t && t <= r)
+                    alive.push_back({a, b});
+            assert(d.comps == brute_components(n, alive));
+        });
+        vector<int> expected(T);
+        iota(expected.begin(), expected.end(), 0);
+        assert(visited == expected);
+    }
+
+    for (int iter = 0; iter < 100; iter++) {
+        int T = rng() % 20 + 1, m = rng() % 10;
+        vector<tuple<unsigned int, int, int>> items;
+        OfflineDeletion<rollback_xor_basis> od(T);
+        for (int i = 0; i < m; i++) {
+            unsigned int x = rng() % 256;
+            int l = rng() % T, r = rng() % T;
+            if (l > r)
+                swap(l, r);
+            items.emplace_back(x, l, r);
+            od.add_update(x, l, r);
+        }
+        rollback_xor_basis basis;
+        od.solve(basis, [&](int t, rollback_xor_basis& b) {
+            vector<unsigned int> alive;
+            for (auto [x, l, r] : items)
+                if (l <= t && t <= r)
+                    alive.push_back(x);
+            assert(b.max_xor() == brute_max_xor(alive));
+        });
+    }
+    return 0;
+}
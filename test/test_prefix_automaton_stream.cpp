@@ -0,0 +1,66 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "prefix_fast.h"
+#include "prefix_automaton_stream.h"
+
+vector<long long> naive(string const& s, string const& t) {
+    vector<long long> res;
+    for (size_t pos = t.find(s); pos != string::npos; pos = t.find(s, pos + 1))
+        res.push_back(pos);
+    return res;
+}
+
+vector<long long> stream_search(StreamMatcher& m, string const& t, vector<size_t> const& cuts) {
+    vector<long long> res;
+    m.reset();
+    size_t last = 0;
+    for (size_t cut : cuts) {
+        m.feed(t.data() + last, cut - last, [&](long long pos) { res.push_back(pos); });
+        last = cut;
+    }
+    m.feed(t.data() + last, t.size() - last, [&](long long pos) { res.push_back(pos); });
+    return res;
+}
+
+int main() {
+    StreamMatcher m("abb");
+    assert(stream_search(m, "aabbabbbcddbadabbaac", {}) == vector<long long>({1, 4, 14}));
+    assert(stream_search(m, "aabbabbbcddbadabbaac", {2, 3, 5, 6, 15}) == vector<long long>({1, 4, 14}));
+
+    mt19937 rng(11);
+    for (int it = 0; it < 3000; it++) {
+        int k = rng() % 4 + 1;
+        int n = rng() % 8 + 1;
+        string s(n, 'a'), t(rng() % 200, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        for (char& c : t)
+            c = 'a' + rng() % (k + 1);
+        if (it % 7 == 0 && !t.empty())
+            t[rng() % t.size()] = char(200);
+
+        string sample;
+        if (it % 2)
+            sample = t.substr(0, t.size() / 2);
+        StreamMatcher m(s, sample);
+        vector<long long> expected = naive(s, t);
+        assert(stream_search(m, t, {}) == expected);
+
+        vector<size_t> cuts;
+        for (size_t i = 0; i < t.size(); i++) {
+            if (rng() % 5 == 0)
+                cuts.push_back(i);
+        }
+        assert(stream_search(m, t, cuts) == expected);
+    }
+
+    // a long text fed byte by byte
+    string s = "needle", t;
+    for (int i = 0; i < 1000; i++)
+        t += (i % 10 == 0 ? "needle" : "needneedl");
+    StreamMatcher big(s, t);
+    vector<size_t> cuts(t.size() - 1);
+    iota(cuts.begin(), cuts.end(), 1);
+    assert(stream_search(big, t, cuts) == naive(s, t));
+}
@@ -0,0 +1,60 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "prim_matrix.h"
+
+int main() {
+    const int INF = 1000000000;
+    mt19937 rng(19);
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 50 + 1;
+        vector<int> w(n * n, INF);
+        vector<array<int, 3>> edges;
+        for (int u = 0; u < n; u++) {
+            for (int v = u + 1; v < n; v++) {
+                if (iter % 2 == 0 || rng() % 10 == 0) {
+                    int x = iter % 4 < 2 ? rng() % 1000 : (int)(rng() % 1000) - 500;
+                    w[u * n + v] = w[v * n + u] = x;
+                    edges.push_back({x, u, v});
+                }
+            }
+        }
+        sort(edges.begin(), edges.end());
+        vector<int> comp(n);
+        iota(comp.begin(), comp.end(), 0);
+        function<int(int)> find = [&](int v) { return comp[v] == v ? v : comp[v] = find(comp[v]); };
+        long long expected = 0;
+        int used = 0;
+        for (auto [x, u, v] : edges) {
+            if (find(u) != find(v)) {
+                comp[find(u)] = find(v);
+                expected += x;
+                used++;
+            }
+        }
+        vector<int> parent;
+        long long total;
+        bool connected = prim_matrix(n, w, parent, total);
+        assert(connected == (used == n - 1));
+        if (connected) {
+            assert(total == expected);
+            long long sum = 0;
+            for (int v = 1; v < n; v++)
+                sum += w[v * n + parent[v]];
+            assert(sum == total && parent[0] == -1);
+        }
+    }
+
+    // a negative MST weight of -1 is not confused with a disconnected graph
+    {
+        int n = 3;
+        vector<int> w = {INF, -3, 5, -3, INF, 2, 5, 2, INF};
+        vector<int> parent;
+        long long total;
+        assert(prim_matrix(n, w, parent, total) && total == -1);
+        w = {INF, -1, INF, -1, INF, INF, INF, INF, INF};
+        assert(!prim_matrix(n, w, parent, total));
+    }
+    return 0;
+}
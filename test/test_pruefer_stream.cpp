@@ -0,0 +1,51 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "pruefer_code_fast.h"
+#include "pruefer_code_stream.h"
+#include "pruefer_decode_stream.h"
+
+int main() {
+    mt19937 rng(13);
+    for (int iter = 0; iter < 300; iter++) {
+        int n = rng() % 40 + 2;
+        vector<int> parent(n, -1);
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        shuffle(order.begin(), order.end(), rng);
+        adj.assign(n, {});
+        for (int i = 1; i < n; i++) {
+            int p = order[iter % 3 == 0 ? i - 1 : rng() % i];
+            parent[order[i]] = p;
+            adj[p].push_back(order[i]);
+            adj[order[i]].push_back(p);
+        }
+        vector<int> expected = pruefer_code();
+
+        vector<int> code, original = parent;
+        pruefer_code_from_parent(parent.data(), n, [&](int v) { code.push_back(v); });
+        assert(code == expected);
+        assert(parent == original);
+
+        vector<pair<int, int>> edges;
+        pruefer_decode_stream(n, code, [&](int u, int v) { edges.push_back({min(u, v), max(u, v)}); });
+        vector<pair<int, int>> tree;
+        for (int v = 0; v < n; v++)
+            if (parent[v] != -1)
+                tree.push_back({min(v, parent[v]), max(v, parent[v])});
+        sort(edges.begin(), edges.end());
+        sort(tree.begin(), tree.end());
+        assert(edges == tree);
+    }
+
+    int n = 1000000;
+    vector<int> parent(n);
+    for (int v = 0; v < n; v++)
+        parent[v] = v - 1;
+    long long sum = 0;
+    int cnt = 0;
+    pruefer_code_from_parent(parent.data(), n, [&](int v) { sum += v; cnt++; });
+    assert(cnt == n - 2 && sum == (long long)(n - 2) * (n - 1) / 2);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "suffix_array_sais.h"
+#include "suffix_array_sais_wrappers.h"
+#include "suffix_array_lcp_construction.h"
+#include "suffix_array_count_distinct_substrings.h"
+
+int main() {
+    assert(count_distinct_substrings("") == 0);
+    assert(count_distinct_substrings("a") == 1);
+    assert(count_distinct_substrings("aaaa") == 4);
+    assert(count_distinct_substrings("abaabcabc") == 35);
+
+    mt19937 rng(3);
+    for (int it = 0; it < 300; it++) {
+        int n = rng() % 30 + 1;
+        int k = rng() % 4 + 1;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        set<string> distinct;
+        for (int l = 0; l < n; l++)
+            for (int r = l + 1; r <= n; r++)
+                distinct.insert(s.substr(l, r - l));
+        assert(count_distinct_substrings(s) == (long long)distinct.size());
+    }
+
+    int n = 100000;
+    assert(count_distinct_substrings(string(n, 'z')) == n);
+    string s(n, 'a');
+    for (char& c : s)
+        c = rng() % 256;
+    long long cnt = count_distinct_substrings(s);
+    assert(cnt > (long long)n * (n + 1) / 2 - 4 * n && cnt <= (long long)n * (n + 1) / 2);
+}
@@ -0,0 +1,69 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "suffix_array_lcp_construction.h"
+#include "suffix_array_sais.h"
+#include "suffix_array_sais_wrappers.h"
+#include "suffix_array_index.h"
+
+int main() {
+    mt19937 rng(40);
+    for (int iter = 0; iter < 300; iter++) {
+        int n = rng() % 80, k = rng() % 3 + 1;
+        string t(n, 'a');
+        for (char& c : t)
+            c = iter % 10 == 0 ? "a\xff"[rng() % 2] : 'a' + rng() % k;
+
+        // store the index in a byte stream and read it back, like a file
+        vector<int> built = SuffixArrayIndex::build(t);
+        stringstream file;
+        file.write((char*)built.data(), built.size() * sizeof(int));
+        vector<int> data(built.size());
+        file.read((char*)data.data(), data.size() * sizeof(int));
+        SuffixArrayIndex index(data.data());
+
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                int l = 0;
+                while (i + l < n && j + l < n && t[i + l] == t[j + l])
+                    l++;
+                assert(index.lce(i, j) == l);
+            }
+        }
+
+        vector<string> patterns;
+        for (int q = 0; q < 30; q++) {
+            string s;
+            if (n > 0 && q % 2 == 0) {
+                int i = rng() % n;
+                s = t.substr(i, rng() % (n - i + 1));
+            } else {
+                s.resize(rng() % 4);
+                for (char& c : s)
+                    c = 'a' + rng() % (k + 1);
+            }
+            patterns.push_back(s);
+
+            vector<int> expected;
+            for (int i = 0; i < n && i + (int)s.size() <= n; i++)
+                if (t.compare(i, s.size(), s) == 0)
+                    expected.push_back(i);
+            assert(index.count(s) == (int)expected.size());
+            assert(index.locate(s) == expected);
+        }
+        vector<int> counts = index.count(patterns, 1 + iter % 4);
+        for (int q = 0; q < (int)patterns.size(); q++)
+            assert(counts[q] == index.count(patterns[q]));
+    }
+
+    string t;
+    for (int i = 0; i < 100000; i++)
+        t += "abcab"[rng() % 5];
+    vector<int> data = SuffixArrayIndex::build(t);
+    SuffixArrayIndex index(data.data());
+    assert(index.count("") == (int)t.size());
+    assert(index.count(t) == 1);
+    assert(index.count(t + "a") == 0);
+    assert(index.lce(0, 0) == (int)t.size());
+}
@@ -0,0 +1,37 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "parallel_for.h"
+#include "suffix_array_sort_cyclic1.h"
+#include "suffix_array_sort_cyclic2.h"
+#include "suffix_array_sort_cyclic3.h"
+#include "suffix_array_construction.h"
+#include "suffix_array_parallel.h"
+
+int main() {
+    mt19937 rng(42);
+    for (int iter = 0; iter < 2000; iter++) {
+        int n = rng() % 50 + 1, k = rng() % 4 + 1, threads = 1 + iter % 4;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        // identical also for cyclic shifts with ties
+        assert(sort_cyclic_shifts_parallel(s, threads) == sort_cyclic_shifts(s));
+        assert(suffix_array_construction_parallel(s, threads) == suffix_array_construction(s));
+    }
+
+    for (string base : {"a", "ab", "abaab"}) {
+        string s;
+        while (s.size() < 20000)
+            s += base;
+        assert(sort_cyclic_shifts_parallel(s, 4) == sort_cyclic_shifts(s));
+    }
+
+    // large enough to use several threads and two radix passes
+    string s(100000, 'a');
+    for (char& c : s)
+        c = 'a' + rng() % 26;
+    for (int threads : {1, 3, 8})
+        assert(suffix_array_construction_parallel(s, threads) == suffix_array_construction(s));
+}
@@ -0,0 +1,67 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "suffix_array_sort_cyclic1.h"
+#include "suffix_array_sort_cyclic2.h"
+#include "suffix_array_sort_cyclic3.h"
+#include "suffix_array_construction.h"
+#include "suffix_array_sais.h"
+#include "suffix_array_sais_wrappers.h"
+
+vector<int> naive_suffix_array(vector<uint32_t> const& s) {
+    int n = s.size();
+    vector<int> p(n);
+    iota(p.begin(), p.end(), 0);
+    sort(p.begin(), p.end(), [&](int a, int b) {
+        return lexicographical_compare(s.begin() + a, s.end(), s.begin() + b, s.end());
+    });
+    return p;
+}
+
+int main() {
+    assert(suffix_array_sais("") == vector<int>{});
+    assert(suffix_array_sais("abaab") == (vector<int>{2, 3, 0, 4, 1}));
+
+    mt19937 rng(39);
+    for (int iter = 0; iter < 2000; iter++) {
+        int n = rng() % 60 + 1, k = rng() % 4 + 1;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        vector<int> expected = suffix_array_construction(s);
+        assert(suffix_array_sais(s) == expected);
+        vector<long long> p64 = suffix_array_sais<long long>(reinterpret_cast<unsigned char const*>(s.data()), n);
+        assert(vector<int>(p64.begin(), p64.end()) == expected);
+    }
+
+    // bytes above 127 must be ordered as unsigned values
+    string bytes = "\xff\x01\x80\x01\xff";
+    vector<uint32_t> as_ints(bytes.begin(), bytes.end());
+    for (auto& x : as_ints)
+        x &= 255;
+    assert(suffix_array_sais(bytes) == naive_suffix_array(as_ints));
+
+    for (int iter = 0; iter < 1000; iter++) {
+        int n = rng() % 50 + 1;
+        bool large = iter % 2;
+        vector<uint32_t> s(n);
+        for (auto& x : s)
+            x = large ? (rng() % 5) * 1000000007u : rng() % 3;
+        assert(suffix_array_sais(s) == naive_suffix_array(s));
+    }
+
+    // periodic strings are the worst case for the recursion
+    for (string base : {"a", "ab", "aab", "abaab"}) {
+        string s;
+        while (s.size() < 5000)
+            s += base;
+        assert(suffix_array_sais(s) == suffix_array_construction(s));
+    }
+
+    int n = 200000;
+    string s(n, 'a');
+    for (char& c : s)
+        c = "ACGT"[rng() % 4];
+    assert(suffix_array_sais(s) == suffix_array_construction(s));
+}
@@ -0,0 +1,89 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+#include "suffix_automaton_transitions.h"
+#include "suffix_automaton_compact.h"
+
+set<string> substrings(vector<string> const& strings) {
+    set<string> result;
+    for (auto const& s : strings)
+        for (size_t i = 0; i < s.size(); i++)
+            for (size_t j = i + 1; j <= s.size(); j++)
+                result.insert(s.substr(i, j - i));
+    return result;
+}
+
+// number of different non-empty strings readable from the initial state
+template <typename SA>
+long long count_paths(SA const& sa) {
+    vector<int> order(sa.size());
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&](int a, int b) { return sa.len[a] > sa.len[b]; });
+    vector<long long> dp(sa.size(), 1);
+    for (int v : order)
+        sa.next.for_each(v, [&](int, int to) { dp[v] += dp[to]; });
+    return dp[0] - 1;
+}
+
+template <typename SA>
+bool accepts(SA const& sa, string const& t, int offset) {
+    int v = 0;
+    for (char c : t) {
+        v = sa.next.get(v, (unsigned char)c - offset);
+        if (v == -1)
+            return false;
+    }
+    return true;
+}
+
+template <typename SA>
+void check(vector<string> const& strings, int offset) {
+    SA sa;
+    for (auto const& s : strings) {
+        sa.new_string();
+        for (char c : s)
+            sa.add((unsigned char)c - offset);
+    }
+    set<string> subs = substrings(strings);
+    assert(count_paths(sa) == (long long)subs.size());
+    for (auto const& t : subs)
+        assert(accepts(sa, t, offset));
+    int total = 0;
+    for (auto const& s : strings)
+        total += s.size();
+    assert(sa.size() <= max(2 * total, 1));
+    for (int v = 1; v < sa.size(); v++)
+        assert(sa.len[sa.link[v]] < sa.len[v]);
+}
+
+int main() {
+    mt19937 rng(43);
+    for (int iter = 0; iter < 500; iter++) {
+        int k = rng() % 3 + 1, cnt = iter % 2 ? rng() % 4 + 1 : 1;
+        vector<string> strings(cnt);
+        for (auto& s : strings) {
+            s.resize(rng() % 15);
+            for (char& c : s)
+                c = 'a' + rng() % k;
+        }
+        check<SuffixAutomaton<DenseTransitions<3>>>(strings, 'a');
+        check<SuffixAutomaton<SmallVectorTransitions<1>>>(strings, 0);
+        check<SuffixAutomaton<SmallVectorTransitions<>>>(strings, 0);
+        check<SuffixAutomaton<HashTransitions>>(strings, 0);
+    }
+
+    // many different bytes force the small vectors to spill
+    string s;
+    for (int i = 0; i < 300; i++)
+        s += (char)(rng() % 256);
+    check<SuffixAutomaton<SmallVectorTransitions<2>>>({s}, 0);
+    check<SuffixAutomaton<HashTransitions>>({s}, 0);
+
+    // "abb...b" gives the maximal number of states
+    string t = "a" + string(1000, 'b');
+    SuffixAutomaton<SmallVectorTransitions<>> sa;
+    for (char c : t)
+        sa.add(c);
+    assert(sa.size() == 2 * (int)t.size() - 1);
+}
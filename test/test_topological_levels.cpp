@@ -0,0 +1,130 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+namespace DFS {
+#include "topological_sort_iterative.h"
+}
+#include "parallel_for.h"
+#include "topological_levels.h"
+
+int main() {
+    mt19937 rng(38);
+    for (int iter = 0; iter < 1000; iter++) {
+        int n = rng() % 30 + 1, m = rng() % 80, threads = 1 + iter % 4;
+        bool acyclic = iter % 4 != 0;
+        vector<int> perm(n);
+        iota(perm.begin(), perm.end(), 0);
+        shuffle(perm.begin(), perm.end(), rng);
+        vector<vector<int>> adj(n);
+        for (int i = 0; i < m; i++) {
+            int a = rng() % n, b = rng() % n;
+            if (acyclic && a == b)
+                continue;
+            if (acyclic && a > b)
+                swap(a, b);
+            adj[perm[a]].push_back(perm[b]);
+        }
+        vector<long long> cost(n);
+        for (auto& c : cost)
+            c = rng() % 10;
+
+        // reference: longest paths by relaxing until nothing changes
+        vector<int> level(n, 0);
+        vector<long long> finish(n);
+        bool has_cycle = false;
+        for (int round = 0; round <= n; round++) {
+            bool changed = false;
+            for (int v = 0; v < n; v++)
+                for (int u : adj[v])
+                    if (level[v] + 1 > level[u])
+                        level[u] = level[v] + 1, changed = true;
+            if (!changed)
+                break;
+            if (round == n)
+                has_cycle = true;
+        }
+        if (!has_cycle) {
+            vector<int> byl(n);
+            iota(byl.begin(), byl.end(), 0);
+            sort(byl.begin(), byl.end(), [&](int a, int b) { return level[a] < level[b]; });
+            vector<long long> st(n, 0);
+            for (int v : byl) {
+                finish[v] = st[v] + cost[v];
+                for (int u : adj[v])
+                    st[u] = max(st[u], finish[v]);
+            }
+        }
+        if (acyclic)
+            assert(!has_cycle);
+
+        DagLevels res;
+        bool ok = topological_levels(adj, cost, res, threads);
+        assert(ok == !has_cycle);
+        vector<int> pos(n, -1);
+        for (int i = 0; i < (int)res.order.size(); i++)
+            pos[res.order[i]] = i;
+        for (int k = 0; k + 1 < (int)res.level_start.size(); k++)
+            for (int i = res.level_start[k]; i < res.level_start[k + 1]; i++)
+                assert(res.level[res.order[i]] == k);
+        assert(res.level_start.back() == (int)res.order.size());
+        for (int v = 0; v < n; v++)
+            for (int u : adj[v])
+                if (pos[v] != -1)
+                    assert(pos[u] == -1 || pos[u] > pos[v]);
+        if (ok) {
+            long long crit = 0;
+            for (int v = 0; v < n; v++) {
+                assert(res.level[v] == level[v]);
+                assert(res.finish[v] == finish[v]);
+                crit = max(crit, finish[v]);
+            }
+            assert(res.critical_path == crit);
+
+            DFS::n = n;
+            DFS::adj = adj;
+            DFS::topological_sort();
+            assert((int)DFS::ans.size() == n);
+            vector<int> p(n);
+            for (int i = 0; i < n; i++)
+                p[DFS::ans[i]] = i;
+            for (int v = 0; v < n; v++)
+                for (int u : adj[v])
+                    assert(p[v] < p[u]);
+        } else {
+            // every unordered vertex still has an unordered predecessor
+            vector<bool> has_pred(n, false);
+            for (int v = 0; v < n; v++)
+                for (int u : adj[v])
+                    if (pos[v] == -1)
+                        has_pred[u] = true;
+            for (int v = 0; v < n; v++)
+                if (pos[v] == -1)
+                    assert(has_pred[v]);
+        }
+    }
+
+    // a long chain with wide levels, processed by several threads
+    int width = 3000, depth = 50, n = width * depth;
+    vector<vector<int>> adj(n);
+    for (int d = 0; d + 1 < depth; d++)
+        for (int i = 0; i < width; i++)
+            for (int j : {i, (i + 1) % width, (i * 7) % width})
+                adj[d * width + i].push_back((d + 1) * width + j);
+    vector<long long> cost(n, 1);
+    DagLevels res;
+    assert(topological_levels(adj, cost, res, 4));
+    assert((int)res.level_start.size() == depth + 1);
+    assert(res.critical_path == depth);
+    for (int v = 0; v < n; v++)
+        assert(res.level[v] == v / width);
+
+    // deep path: the iterative DFS must not overflow the stack
+    DFS::n = 1000000;
+    DFS::adj.assign(DFS::n, {});
+    for (int v = 0; v + 1 < DFS::n; v++)
+        DFS::adj[v].push_back(v + 1);
+    DFS::topological_sort();
+    for (int i = 0; i < DFS::n; i++)
+        assert(DFS::ans[i] == i);
+}
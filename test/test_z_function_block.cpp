@@ -0,0 +1,41 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "z_function_block.h"
+
+vector<int> z_naive(string const& s) {
+    int n = s.size();
+    vector<int> z(n, 0);
+    for (int i = 1; i < n; i++)
+        while (i + z[i] < n && s[z[i]] == s[i + z[i]])
+            z[i]++;
+    return z;
+}
+
+int main() {
+    assert(z_function("") == vector<int>());
+    assert(z_function("aaaaa") == vector<int>({0, 4, 3, 2, 1}));
+    assert(z_function("aaabaab") == vector<int>({0, 2, 1, 0, 2, 1, 0}));
+    assert(z_function("abacaba") == vector<int>({0, 0, 1, 0, 3, 0, 1}));
+
+    mt19937 rng(13);
+    for (int it = 0; it < 2000; it++) {
+        int n = rng() % 100;
+        int k = rng() % 3 + 1;
+        string s(n, 'a');
+        for (char& c : s)
+            c = 'a' + rng() % k;
+        if (it % 3 == 0) {
+            // periodic string with a few errors
+            int p = rng() % 10 + 1;
+            for (int i = p; i < n; i++)
+                s[i] = rng() % 50 ? s[i - p] : 'z';
+        }
+        assert(z_function(s) == z_naive(s));
+        string_view middle(s);
+        if (n > 2) {
+            middle = middle.substr(1, n - 2);
+            assert(z_function(middle) == z_naive(string(middle)));
+        }
+    }
+}